@@ -9,10 +9,16 @@
 #define INC_COVID_DATABASE_UTILITY_H_
 
 #include <algorithm>
+#include <atomic>
+#include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <regex>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "country_record.h"
@@ -20,17 +26,26 @@
 namespace covid_database {
 class utility {
   public:
-	static void openAndReadFile(std::ifstream& file);
+	static void openAndReadShards(std::vector<std::string>& shard_paths);
+	static std::vector<std::string> resolveShardPaths(std::string path);
+	static void openDataFile(std::ifstream& file, const std::string& file_name);
+	static void loadShardsConcurrently(
+	    std::vector<std::string>& shard_paths,
+	    std::vector<std::vector<country_record>>& shards);
+	static void mergeShards(std::vector<std::vector<country_record>>& shards);
 	static void parseDataIntoVector(std::ifstream& file,
+	                                const std::string& file_name,
 	                                std::vector<country_record>& dataset);
 	static bool isNameTokenComplete(std::string token);
 	static std::string completeNameToken(std::string line);
 
 	static void populateCountryVector(std::vector<std::string>& tokens,
 	                                  std::vector<country_record>& dataset,
+	                                  const std::string& file_name,
 	                                  int& line_number);
 	static bool validateNumber(std::string number);
-	static int sortData(std::vector<country_record>& dataset);
+	static int sortShardedData(std::vector<std::vector<country_record>>& shards,
+	                           std::vector<country_record>& top_records);
 	static void getSortParameters(int& field_number, int& sort_order);
 
 	static void printGraph(std::vector<country_record>& dataset,
@@ -10,21 +10,25 @@
 using namespace std;
 
 int main() {
-	ifstream file;
-	vector<covid_database::country_record> dataset;
+	vector<string> shard_paths;
+	vector<vector<covid_database::country_record>> shards;
+	vector<covid_database::country_record> top_records;
 
-	// Stage 1: Open and Read File.
-	covid_database::utility::openAndReadFile(file);
+	// Stage 1: Locate Data Files.
+	covid_database::utility::openAndReadShards(shard_paths);
 
-	// Stage 2: Parse and Store.
-	covid_database::utility::parseDataIntoVector(file, dataset);
+	// Stage 2: Parse Each Shard Concurrently.
+	covid_database::utility::loadShardsConcurrently(shard_paths, shards);
 
-	// Stage 3: Sorting Data.
-	auto field_number = covid_database::utility::sortData(dataset);
+	// Stage 3: Deduplicate and Merge.
+	covid_database::utility::mergeShards(shards);
 
-	// Stage 4: Printing Graph.
-	covid_database::utility::printGraph(dataset, field_number);
+	// Stage 4: Sorting Data.
+	auto field_number =
+	    covid_database::utility::sortShardedData(shards, top_records);
+
+	// Stage 5: Printing Graph.
+	covid_database::utility::printGraph(top_records, field_number);
 
-	file.close();
 	return 0;
 }
@@ -14,6 +14,8 @@ static constexpr size_t expected_tokens_per_line = 11;
 static constexpr size_t file_error_code          = 69;
 static constexpr size_t console_char_limit       = 70;
 static constexpr size_t input_buffer_clear_size  = 6969;
+static constexpr size_t records_to_graph         = 10;
+static constexpr char shard_extension[]          = ".csv";
 
 // Used for accessing members in each line of CSV file.
 static constexpr size_t index_of_name            = 0;
@@ -38,51 +40,215 @@ static constexpr size_t ascending = 1;
 namespace covid_database {
 
 /**
- * Func Name: openAndReadFile.
- * Description: Opens a user in the project directory based on user input for
- * the name.
- * Parameters: Takes a reference to a file object.
+ * Func Name: openAndReadShards.
+ * Description: Resolves a user supplied filename, directory or glob pattern
+ * into the list of shard files to load.
+ * Parameters: Takes a reference to a vector to store the shard paths in.
  * Return Type: N/A.
  */
-void utility::openAndReadFile(ifstream& file) {
-	string file_name;
+void utility::openAndReadShards(vector<string>& shard_paths) {
+	string path;
 	cout << "Welcome to the COVID-19 Data Interpreter!" << endl;
-	cout << "Enter the data filename: ";
-	cin >> file_name;
+	cout << "Enter the data filename, directory or glob: ";
+	cin >> path;
 
-	file.open(file_name);
+	shard_paths = resolveShardPaths(path);
 
-	while (!file.is_open()) {
-		cerr << "Error: Filename '" << file_name
-		     << "' does not exist in current directory!" << endl;
-		cout << "Enter the data filename: ";
+	while (shard_paths.empty()) {
+		cerr << "Error: No data files match '" << path << "'!" << endl;
+		cout << "Enter the data filename, directory or glob: ";
 
 		// Clear input buffer in case there are invaid chars left behind.
 		cin.clear();
 		cin.ignore(input_buffer_clear_size, '\n');
 
-		cin >> file_name;
-		file.open(file_name);
+		cin >> path;
+		shard_paths = resolveShardPaths(path);
 	}
 
-	cout << "File opened successfully!\n" << endl;
+	cout << "Found " << shard_paths.size() << " data file(s)!\n" << endl;
+}
+
+/**
+ * Func Name: resolveShardPaths.
+ * Description: Expands a path into shard files. A directory yields every CSV
+ * file inside it, and a * or ? in the filename is matched against the files
+ * in its parent directory.
+ * Parameters: Takes a filename, directory or glob pattern.
+ * Return Type: Shard paths in lexicographic order, which is also the order
+ * used for resolving duplicates. Empty if nothing matched or the directory
+ * could not be read.
+ */
+vector<string> utility::resolveShardPaths(string path) {
+	namespace fs = std::filesystem;
+	vector<string> shard_paths;
+	error_code error;
+	fs::path directory;
+	regex glob;
+	bool match_extension = false;
+
+	if (fs::is_directory(path, error)) {
+		directory       = path;
+		match_extension = true;
+	} else if (path.find_first_of("*?") != string::npos) {
+		fs::path pattern(path);
+		directory = pattern.parent_path();
+		if (directory.empty()) { directory = "."; }
+
+		// Translate the glob into a regex, escaping everything else.
+		string expression;
+		for (auto c : pattern.filename().string()) {
+			if (c == '*') {
+				expression += ".*";
+			} else if (c == '?') {
+				expression += '.';
+			} else if (string("\\^$.|+()[]{}").find(c) != string::npos) {
+				expression += string("\\") + c;
+			} else {
+				expression += c;
+			}
+		}
+		glob = regex(expression);
+	} else {
+		if (fs::is_regular_file(path, error)) { shard_paths.push_back(path); }
+		return shard_paths;
+	}
+
+	// Use the non-throwing overloads so an unreadable entry reprompts instead
+	// of terminating.
+	for (fs::directory_iterator it(directory, error), end;
+	     !error && it != end;
+	     it.increment(error)) {
+		if (!it->is_regular_file(error)) { continue; }
+
+		auto matches = match_extension
+		                   ? it->path().extension() == shard_extension
+		                   : regex_match(it->path().filename().string(), glob);
+		if (matches) { shard_paths.push_back(it->path().string()); }
+	}
+
+	if (error) {
+		cerr << "Error: Could not read '" << directory.string()
+		     << "': " << error.message() << endl;
+		shard_paths.clear();
+	}
+
+	sort(shard_paths.begin(), shard_paths.end());
+	return shard_paths;
+}
+
+/**
+ * Func Name: openDataFile.
+ * Description: Opens a data file and checks that it is not empty.
+ * Parameters: Takes a reference to a file object and the filename to open.
+ * Return Type: N/A. Throws runtime_error if the file cannot be used.
+ */
+void utility::openDataFile(ifstream& file, const string& file_name) {
+	file.open(file_name);
+
+	if (!file.is_open()) {
+		throw runtime_error("Error: Could not open '" + file_name + "'!");
+	}
 
 	// Check to see if the file is empty.
 	if (file.peek() == ifstream::traits_type::eof()) {
-		cerr << "Error: file is empty!" << endl;
-		file.close();
-		exit(file_error_code);
+		throw runtime_error("Error: file '" + file_name + "' is empty!");
+	}
+}
+
+/**
+ * Func Name: loadShardsConcurrently.
+ * Description: Parses the shard files with one parser per shard, running at
+ * most one worker per hardware thread. Exits once every worker has finished
+ * if any shard failed to load.
+ * Parameters: Takes a reference to the shard paths and a reference to a vector
+ * to store each shard's records in, in the same order as the paths.
+ * Return Type: N/A.
+ */
+void utility::loadShardsConcurrently(vector<string>& shard_paths,
+                                     vector<vector<country_record>>& shards) {
+	vector<string> errors(shard_paths.size());
+	vector<future<void>> workers;
+	atomic<size_t> next_shard{0};
+
+	shards.assign(shard_paths.size(), {});
+
+	size_t worker_count = max(1u, thread::hardware_concurrency());
+	worker_count        = min(worker_count, shard_paths.size());
+
+	for (size_t w = 0; w < worker_count; w++) {
+		workers.push_back(async(launch::async, [&]() {
+			for (auto s = next_shard++; s < shard_paths.size();
+			     s       = next_shard++) {
+				try {
+					ifstream file;
+					openDataFile(file, shard_paths.at(s));
+					parseDataIntoVector(file, shard_paths.at(s), shards.at(s));
+				} catch (const exception& e) {
+					errors.at(s) = e.what();
+				}
+			}
+		}));
+	}
+
+	for (auto& worker : workers) { worker.get(); }
+
+	// Report every failed shard, only once all workers have been joined.
+	bool load_failed = false;
+	for (auto& error : errors) {
+		if (error.empty()) { continue; }
+		cerr << error << endl;
+		load_failed = true;
 	}
+
+	if (load_failed) { exit(file_error_code); }
+}
+
+/**
+ * Func Name: mergeShards.
+ * Description: Deduplicates records on country code across all shards, keeping
+ * the record from the last shard (and last line) it appears in. The pruned
+ * shards together form the merged dataset.
+ * Parameters: Takes a reference to the loaded shards, which are pruned to the
+ * surviving records.
+ * Return Type: N/A.
+ */
+void utility::mergeShards(vector<vector<country_record>>& shards) {
+	// Maps each country code to the shard and position of its latest record.
+	unordered_map<string, pair<size_t, size_t>> latest_record;
+
+	for (size_t s = 0; s < shards.size(); s++) {
+		for (size_t i = 0; i < shards.at(s).size(); i++) {
+			latest_record[shards.at(s).at(i).getCode()] = {s, i};
+		}
+	}
+
+	for (size_t s = 0; s < shards.size(); s++) {
+		vector<country_record> survivors;
+
+		for (size_t i = 0; i < shards.at(s).size(); i++) {
+			auto& record = shards.at(s).at(i);
+			if (latest_record.at(record.getCode()) == make_pair(s, i)) {
+				survivors.push_back(record);
+			}
+		}
+
+		shards.at(s) = move(survivors);
+	}
+
+	cout << "Merged " << latest_record.size() << " unique countries from "
+	     << shards.size() << " data file(s)!\n" << endl;
 }
 
 /**
  * Func Name: parseDataIntoVector.
  * Description: Takes data from CSV file and places it into a vector.
- * Parameters: Takes a reference to a file object and a reference to a vector to
- * store the data in.
- * Return Type: N/A.
+ * Parameters: Takes a reference to a file object, the filename used in error
+ * messages, and a reference to a vector to store the data in.
+ * Return Type: N/A. Throws runtime_error if the file is malformed.
  */
 void utility::parseDataIntoVector(ifstream& file,
+                                  const string& file_name,
                                   vector<country_record>& dataset) {
 	// Dirty bool for bypassing the first line of the CSV file.
 	bool first_line_not_parsed = true;
@@ -99,9 +265,8 @@ void utility::parseDataIntoVector(ifstream& file,
 		// Error checking to ensure file formatting is correct.
 		auto format_correct = line[0] == '\"';
 		if (!format_correct) {
-			cerr << "Error: file format incorrect!" << endl;
-			file.close();
-			exit(file_error_code);
+			throw runtime_error("Error: file '" + file_name +
+			                    "' format incorrect!");
 		}
 
 		while (getline(s_stream, current_token, delim)) {
@@ -128,10 +293,9 @@ void utility::parseDataIntoVector(ifstream& file,
 
 		// Error checking to see if enough tokens in each line.
 		if (tokens_in_line.size() != expected_tokens_per_line) {
-			cerr << "Error: Not enough data provided on line " << line_count
-			     << endl;
-			file.close();
-			exit(file_error_code);
+			throw runtime_error("Error: Not enough data provided in '" +
+			                    file_name + "' on line " +
+			                    to_string(line_count));
 		}
 
 		// Don't add first line obtained from file, as it's not useful.
@@ -140,7 +304,7 @@ void utility::parseDataIntoVector(ifstream& file,
 			continue;
 		}
 
-		populateCountryVector(tokens_in_line, dataset, line_count);
+		populateCountryVector(tokens_in_line, dataset, file_name, line_count);
 		line_count++;
 	}
 }
@@ -177,13 +341,18 @@ string utility::completeNameToken(string line) {
  * Description: Creates an instance of a country_record, and pushes it into a
  * vector.
  * Parameters: Takes a reference to a vector of strings containing the
- * tokenized line, and the destination vector of country_record to write this
- * data into.
- * Return Type: N/A.
+ * tokenized line, the destination vector of country_record to write this
+ * data into, and the filename and line number used in error messages.
+ * Return Type: N/A. Throws runtime_error if the line holds invalid data.
  */
 void utility::populateCountryVector(vector<string>& tokens,
                                     vector<country_record>& dataset,
+                                    const string& file_name,
                                     int& line_number) {
+	auto invalid_data = runtime_error("Error: Invalid data detected in '" +
+	                                  file_name + "' on line " +
+	                                  to_string(line_number));
+
 	// Error checking for numeric values.
 	if (!validateNumber(tokens.at(index_of_new_confirmed)) ||
 	    !validateNumber(tokens.at(index_of_new_deaths)) ||
@@ -191,20 +360,22 @@ void utility::populateCountryVector(vector<string>& tokens,
 	    !validateNumber(tokens.at(index_of_total_confirmed)) ||
 	    !validateNumber(tokens.at(index_of_total_deaths)) ||
 	    !validateNumber(tokens.at(index_of_total_recovered))) {
-		cerr << "Error: Invalid data detected on line " << line_number << endl;
-		exit(file_error_code);
+		throw invalid_data;
 	}
 
-	country_record data{tokens.at(index_of_name),
-	                    tokens.at(index_of_code),
-	                    tokens.at(index_of_new_confirmed),
-	                    tokens.at(index_of_new_deaths),
-	                    tokens.at(index_of_new_recovered),
-	                    tokens.at(index_of_total_confirmed),
-	                    tokens.at(index_of_total_deaths),
-	                    tokens.at(index_of_total_recovered)};
-
-	dataset.push_back(data);
+	// stoi still rejects empty or out of range values.
+	try {
+		country_record data{tokens.at(index_of_name),
+		                    tokens.at(index_of_code),
+		                    tokens.at(index_of_new_confirmed),
+		                    tokens.at(index_of_new_deaths),
+		                    tokens.at(index_of_new_recovered),
+		                    tokens.at(index_of_total_confirmed),
+		                    tokens.at(index_of_total_deaths),
+		                    tokens.at(index_of_total_recovered)};
+
+		dataset.push_back(data);
+	} catch (const logic_error&) { throw invalid_data; }
 }
 
 /**
@@ -219,39 +390,65 @@ bool utility::validateNumber(string number) {
 }
 
 /**
- * Func Name: sortData.
- * Description: Sorts vector of data based on user input selections.
- * Parameters: Takes a reference to the data vector.
+ * Func Name: sortShardedData.
+ * Description: Finds the top records across all shards based on user input
+ * selections, by selecting the top records of each shard and then merging
+ * those short lists rather than sorting the whole dataset.
+ * Parameters: Takes a reference to the deduplicated shards and a reference to a
+ * vector to store the merged top records in.
  * Return Type: Sorting field number selected by user through menu.
  */
-int utility::sortData(vector<country_record>& dataset) {
+int utility::sortShardedData(vector<vector<country_record>>& shards,
+                             vector<country_record>& top_records) {
 	int field_number;
 	int sort_order;
+	bool (*compare)(country_record&, country_record&);
 
 	getSortParameters(field_number, sort_order);
 
 	switch (field_number) {
-		case new_confirmed_sort:
-			std::sort(dataset.begin(), dataset.end(), compareNewConfirmed);
-			break;
-		case new_deaths_sort:
-			std::sort(dataset.begin(), dataset.end(), compareNewDeaths);
-			break;
-		case new_recovered_sort:
-			std::sort(dataset.begin(), dataset.end(), compareNewRecovered);
-			break;
-		case total_confirmed_sort:
-			std::sort(dataset.begin(), dataset.end(), compareTotalConfirmed);
-			break;
-		case total_deaths_sort:
-			std::sort(dataset.begin(), dataset.end(), compareTotalDeaths);
-			break;
-		default:
-			std::sort(dataset.begin(), dataset.end(), compareTotalRecovered);
+		case new_confirmed_sort: compare = compareNewConfirmed; break;
+		case new_deaths_sort: compare = compareNewDeaths; break;
+		case new_recovered_sort: compare = compareNewRecovered; break;
+		case total_confirmed_sort: compare = compareTotalConfirmed; break;
+		case total_deaths_sort: compare = compareTotalDeaths; break;
+		default: compare = compareTotalRecovered;
 	}
 
-	// Reverse the sorted vector if output needs to be descending.
-	if (sort_order != ascending) { reverse(dataset.begin(), dataset.end()); }
+	// Returns true if first should be graphed before second.
+	auto ranks_before = [&](country_record& first, country_record& second) {
+		if (sort_order == ascending) { return compare(first, second); }
+		return compare(second, first);
+	};
+
+	// Order only the leading records of each shard.
+	vector<size_t> shard_heads(shards.size(), 0);
+	vector<size_t> shard_limits;
+	for (auto& shard : shards) {
+		auto limit = min(records_to_graph, shard.size());
+		partial_sort(shard.begin(), shard.begin() + limit, shard.end(),
+		             ranks_before);
+		shard_limits.push_back(limit);
+	}
+
+	// Merge the per-shard top records by repeatedly taking the best head.
+	while (top_records.size() < records_to_graph) {
+		auto best = shards.size();
+		for (size_t s = 0; s < shards.size(); s++) {
+			if (shard_heads.at(s) == shard_limits.at(s)) { continue; }
+			if (best == shards.size() ||
+			    ranks_before(shards.at(s).at(shard_heads.at(s)),
+			                 shards.at(best).at(shard_heads.at(best)))) {
+				best = s;
+			}
+		}
+
+		// Every shard has been exhausted.
+		if (best == shards.size()) { break; }
+
+		top_records.push_back(shards.at(best).at(shard_heads.at(best)));
+		shard_heads.at(best)++;
+	}
 
 	return field_number;
 }
@@ -308,7 +505,7 @@ void utility::getSortParameters(int& field_number, int& sort_order) {
 
 /**
  * Func Name: printGraph.
- * Description: Prints a horizontal bar chart for top 10 values based on what
+ * Description: Prints a horizontal bar chart for the top records based on what
  * field the user selected.
  * Parameters: Takes a reference to the country vector and field number.
  * Return Type: N/A.
@@ -323,8 +520,8 @@ void utility::printGraph(vector<country_record>& dataset, int& field_number) {
 
 /**
  * Func Name: accumulateData.
- * Description: Accumulates top 10 values from country vector into data_to_print
- * based on what field the user selected.
+ * Description: Accumulates the top records' values from country vector into
+ * data_to_print based on what field the user selected.
  * Parameters: Takes a reference to country data, printing data, and field
  * number.
  * Return Type: N/A.
@@ -332,33 +529,36 @@ void utility::printGraph(vector<country_record>& dataset, int& field_number) {
 void utility::accumulateData(vector<country_record>& dataset,
                              vector<int>& data_to_print,
                              int& field_number) {
+	auto records = min(records_to_graph, dataset.size());
+
 	switch (field_number) {
 		case new_confirmed_sort:
-			for (auto i = 0; i < 10; i++) {
+			for (size_t i = 0; i < records; i++) {
 				data_to_print.push_back(dataset.at(i).getNewConfirmedCases());
 			}
 			break;
 		case new_deaths_sort:
-			for (auto i = 0; i < 10; i++) {
+			for (size_t i = 0; i < records; i++) {
 				data_to_print.push_back(dataset.at(i).getNewDeaths());
 			}
 			break;
 		case new_recovered_sort:
-			for (auto i = 0; i < 10; i++) {
+			for (size_t i = 0; i < records; i++) {
 				data_to_print.push_back(dataset.at(i).getNewReoveredCases());
 			}
+			break;
 		case total_confirmed_sort:
-			for (auto i = 0; i < 10; i++) {
+			for (size_t i = 0; i < records; i++) {
 				data_to_print.push_back(dataset.at(i).getTotalConfirmedCases());
 			}
 			break;
 		case total_deaths_sort:
-			for (auto i = 0; i < 10; i++) {
+			for (size_t i = 0; i < records; i++) {
 				data_to_print.push_back(dataset.at(i).getTotalDeaths());
 			}
 			break;
 		default:
-			for (auto i = 0; i < 10; i++) {
+			for (size_t i = 0; i < records; i++) {
 				data_to_print.push_back(dataset.at(i).getTotalRecoveredCases());
 			}
 	}
@@ -376,11 +576,12 @@ int utility::calculateAndInsertBars(vector<country_record>& dataset,
 	int max_value     = 0;
 	int bars_to_print = 0;
 	int bar_weightage = 0;
+	auto records      = min(records_to_graph, dataset.size());
 
 	// Limit the max number of #s to 70.
 	int max_bar_len = console_char_limit;
 
-	for (auto i = 0; i < 10; i++) {
+	for (size_t i = 0; i < records; i++) {
 		if (data_to_print.at(i) > max_value) {
 			max_value = data_to_print.at(i);
 		}
@@ -392,7 +593,7 @@ int utility::calculateAndInsertBars(vector<country_record>& dataset,
 	// Ensure we don't divide by 0.
 	if (max_bar_len != 0) { bar_weightage = max_value / max_bar_len; }
 
-	for (auto i = 0; i < 10; i++) {
+	for (size_t i = 0; i < records; i++) {
 		string bars;
 		auto name = dataset.at(i).getCode();
 